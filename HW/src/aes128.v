@@ -11,9 +11,44 @@ output reg [127:0] cipher_text_o;
 /* Output to indicate cipher ready and key ready */
 output reg cipher_ready_o, key_ready_o;
 
+/* 
+    S-box implementation (see sub_word):
+    0. SBOX_LUT: LUT case tables (default)
+    1. SBOX_BRAM: Dual port block RAM, adds one clock cycle to every key schedule and cipher round
+    2. SBOX_GF: Composite field GF((2^4)^2) logic shared by S box and inverse S box
+*/
+parameter SBOX_IMPL = 0;
+
+`include "aes128_params.vh"
+
+/* 
+    Cipher directions built into the core:
+    0. CIPHER_ENC_DEC: Encryption and decryption selected by enc_or_dec_i (default)
+    1. CIPHER_ENC: Encryption only, enc_or_dec_i is ignored (CTR, GCM, CMAC)
+    2. CIPHER_DEC: Decryption only, enc_or_dec_i is ignored
+*/
+parameter CIPHER_MODE = 0;
+
+/* Register in the middle of every cipher round, adds one clock cycle to every cipher round */
+parameter ROUND_REG = 0;
+
+/* Clock cycles to wait for the S-box output in each key schedule round */
+localparam SBOX_LATENCY = (SBOX_IMPL == SBOX_BRAM) ? 1 : 0;
+
+/* Clock cycles to wait for the registered S-box or mid round register in each cipher round */
+localparam ROUND_LATENCY = ((SBOX_LATENCY != 0) || (ROUND_REG != 0)) ? 1 : 0;
+
+/* Direction of the cipher, fixed for encryption only and decryption only cores */
+wire enc_sel;
+
+assign enc_sel = (CIPHER_MODE == CIPHER_ENC) ? 1'h1 : ((CIPHER_MODE == CIPHER_DEC) ? 1'h0 : enc_or_dec_i);
+
 /* Registers for counters - Key round and statre round numbers */
 reg [7:0] key_round_num, state_round_num;
 
+/* Registers to count the wait cycles within a key and state round */
+reg key_round_wait, state_round_wait;
+
 /* Wire to decide if the round needs mix column operation */
 wire mix_col_i;
 
@@ -22,10 +57,12 @@ initial cipher_ready_o = 1'h0;
 initial key_ready_o = 1'h0;
 initial key_round_num = 8'h0;
 initial state_round_num = 8'h0;
+initial key_round_wait = 1'h0;
+initial state_round_wait = 1'h0;
 initial cipher_text_o = 128'h0;
 
 /* Decide whether mix column stage is required for that particular round based on encryption or decryption process */
-assign mix_col_i = (enc_or_dec_i) ? ((state_round_num == 8'hB) ? 1'h0 : 1'h1) : ((state_round_num == 8'hFF) ? 1'h0 : 1'h1);
+assign mix_col_i = (enc_sel) ? ((state_round_num == 8'hB) ? 1'h0 : 1'h1) : ((state_round_num == 8'hFF) ? 1'h0 : 1'h1);
 
 /* Register to store the state, input to key schedule and input round key */
 reg [127:0] state_i, key_schedule_i, state_key_i;
@@ -49,8 +86,8 @@ reg [2:0] key_schedule_state;
 reg [127:0] round_keys [0:10];
 
 /* Instantiate the key schedule module */
-key_schedule
-    key_rounds (.round_num(key_round_num), .key_i(key_schedule_i), .key_r(key_schedule_o));
+key_schedule #(.SBOX_IMPL(SBOX_IMPL))
+    key_rounds (.clk_i(clk_i), .round_num(key_round_num), .key_i(key_schedule_i), .key_r(key_schedule_o));
 
 /* FSM to generate keys in key schedule */
 always @ (posedge clk_i)
@@ -60,6 +97,7 @@ begin
     begin
         key_ready_o <= 8'h0; // Clear the key ready line since key schedule is starting
         key_round_num <= 8'h1; // Reset key schedule round number to 1
+        key_round_wait <= 1'h0; // Restart the S-box wait for the first round
         round_keys[0] <= cipher_key_i; // Save the initial cipher key in location 0
         key_schedule_i <= cipher_key_i; // Also input the key to the key schedule
         key_schedule_state <= STATE_KEYGEN_IN_PROG; // Change the state to key gen in progress
@@ -69,19 +107,27 @@ begin
         case (key_schedule_state)
             STATE_KEYGEN_IN_PROG:
             begin
-                /* Store the obtained key in respective memory location */
-                round_keys[key_round_num] <= key_schedule_o;
-                if (key_round_num == 8'hA)
+                if ((SBOX_LATENCY != 0) && (key_round_wait == 1'h0))
                 begin
-                    /* 10th round is the final round in key schedule 
-                        hence change the state to final */
-                    key_schedule_state <= STATE_KEYGEN_FINAL;
+                    key_round_wait <= 1'h1; // Registered S-box is reading the key, output is valid next cycle
                 end
                 else
                 begin
-                    key_schedule_i <= key_schedule_o; // Feed the output of previous round as input
-                    key_round_num <= key_round_num + 8'h1; // Update the key schedule round number
-                end     
+                    key_round_wait <= 1'h0;
+                    /* Store the obtained key in respective memory location */
+                    round_keys[key_round_num] <= key_schedule_o;
+                    if (key_round_num == 8'hA)
+                    begin
+                        /* 10th round is the final round in key schedule 
+                            hence change the state to final */
+                        key_schedule_state <= STATE_KEYGEN_FINAL;
+                    end
+                    else
+                    begin
+                        key_schedule_i <= key_schedule_o; // Feed the output of previous round as input
+                        key_round_num <= key_round_num + 8'h1; // Update the key schedule round number
+                    end     
+                end
             end
             STATE_KEYGEN_FINAL:
             begin
@@ -113,12 +159,12 @@ reg [2:0] encrypt_state;
 reg [2:0] decrypt_state;
 
 /* Instaintiate the round module to perform one round of encryption / decryption with selective mix columns */
-round
-    rounds (.state_i(state_i), .key_i(state_key_i), .mix_col_i(mix_col_i), .enc_or_dec_i(enc_or_dec_i), .state_o(state_o));
+round #(.SBOX_IMPL(SBOX_IMPL), .CIPHER_MODE(CIPHER_MODE), .ROUND_REG(ROUND_REG))
+    rounds (.clk_i(clk_i), .state_i(state_i), .key_i(state_key_i), .mix_col_i(mix_col_i), .enc_or_dec_i(enc_sel), .state_o(state_o));
 
 always @ (posedge clk_i)
 begin
-    if (enc_or_dec_i) // Encryption
+    if (enc_sel) // Encryption
     begin
         if (key_ready_o & load_data_i) // Load the data only if the keys are ready
         begin 
@@ -126,12 +172,19 @@ begin
             state_key_i <= round_keys[1]; // Load the key 1 from memory 
             state_i <= (plain_text_i ^ round_keys[0]); // Add 0th round key with plain text and send it as I/P
             state_round_num <= 8'h2; // Set the state round number to 2, as that key will only be used next
+            state_round_wait <= 1'h0; // Restart the round wait for the first round
             encrypt_state <= STATE_ENCRYPT_IN_PROG; // Set the encrypt state to in progress
         end
         else
             case (encrypt_state)
                 STATE_ENCRYPT_IN_PROG:
+                if ((ROUND_LATENCY != 0) && (state_round_wait == 1'h0))
                 begin
+                    state_round_wait <= 1'h1; // First half of the round is being registered, output is valid next cycle
+                end
+                else
+                begin
+                    state_round_wait <= 1'h0;
                     state_i <= state_o; // Feed the output of previous round as input
                     if (state_round_num == 8'hB) // 10 rounds in encryption for AES-128
                     begin
@@ -155,13 +208,20 @@ begin
             state_key_i <= round_keys[9]; // Load the key 9 from memory 
             state_i <= (plain_text_i ^ round_keys[10]); // Add 10th round key with plain text and send it as I/P
             state_round_num <= 8'h8; // Set the state round number to 8, as that key will only be used next
+            state_round_wait <= 1'h0; // Restart the round wait for the first round
             decrypt_state <= STATE_DECRYPT_IN_PROG; // Set the decrypt state to in progress
         end
         else
         begin
             case (decrypt_state)
                 STATE_DECRYPT_IN_PROG:
+                if ((ROUND_LATENCY != 0) && (state_round_wait == 1'h0))
+                begin
+                    state_round_wait <= 1'h1; // First half of the round is being registered, output is valid next cycle
+                end
+                else
                 begin
+                   state_round_wait <= 1'h0;
                    state_i <= state_o; // Feed the output of previous round as input
                    if (state_round_num == 8'hFF) // 10 rounds in encryption for AES-128 (rollover to FF upon decerement)
                    begin
@@ -0,0 +1,11 @@
+/* Parameter values shared by the aes128 modules, included inside each module that uses them */
+
+/* SBOX_IMPL: S-box implementation, see sub_word */
+localparam  SBOX_LUT = 0,
+            SBOX_BRAM = 1,
+            SBOX_GF = 2;
+
+/* CIPHER_MODE: Cipher directions built into the core, see aes128 */
+localparam  CIPHER_ENC_DEC = 0,
+            CIPHER_ENC = 1,
+            CIPHER_DEC = 2;
@@ -0,0 +1,132 @@
+/*
+    Module to count the activity of an aes128 core
+    Connect it to the same clock and control / status lines as the aes128 core it monitors.
+    The counters are read 32-bits at a time through the AXI GPIO, like the cipher text:
+    1. Make perf_latch_i high for one clock cycle to copy all counters, including that cycle, into the read registers
+    2. Select the counter and word with perf_sel_i = { counter, high word } and read perf_data_o
+    perf_clear_i clears the counters, when asserted with perf_latch_i the values before the clear are latched
+*/
+module aes128_perf (clk_i, reset_key_i, load_data_i, enc_or_dec_i, key_ready_i, cipher_ready_i, perf_latch_i, perf_clear_i, perf_sel_i, perf_data_o);
+
+parameter CIPHER_MODE = 0; // Same as the monitored aes128 core
+
+`include "aes128_params.vh"
+
+/*
+    Counters:
+    0. PERF_TOTAL_CYCLES: Clock cycles since the last clear
+    1. PERF_BUSY_CYCLES: Clock cycles spent in the key schedule or in a cipher
+    2. PERF_ENC_BLOCKS: Blocks encrypted
+    3. PERF_DEC_BLOCKS: Blocks decrypted
+    4. PERF_KEY_LOADS: Keys loaded, counted once per rising edge of reset key
+    5. PERF_KEY_CYCLES: Clock cycles spent in the key schedule (no block can be loaded)
+    6. PERF_OUT_STALL_CYCLES: Idle clock cycles with a result on the cipher text output and no new block loaded
+    7. PERF_DROPPED_LOADS: Clock cycles load data was high but ignored as the key schedule was not complete
+*/
+localparam  PERF_TOTAL_CYCLES = 3'd0,
+            PERF_BUSY_CYCLES = 3'd1,
+            PERF_ENC_BLOCKS = 3'd2,
+            PERF_DEC_BLOCKS = 3'd3,
+            PERF_KEY_LOADS = 3'd4,
+            PERF_KEY_CYCLES = 3'd5,
+            PERF_OUT_STALL_CYCLES = 3'd6,
+            PERF_DROPPED_LOADS = 3'd7;
+
+/* Input clock and control lines of the aes128 core */
+input clk_i, reset_key_i, load_data_i, enc_or_dec_i;
+/* Status lines of the aes128 core */
+input key_ready_i, cipher_ready_i;
+/* Latch and clear the counters */
+input perf_latch_i, perf_clear_i;
+/* Counter select - { counter number, high word } */
+input [3:0] perf_sel_i;
+
+/* Selected 32-bit word of the latched counter */
+output [31:0] perf_data_o;
+
+/* Running counters and the copy read by the host */
+reg [63:0] counters [0:7];
+reg [63:0] latched [0:7];
+
+/* Key schedule in progress, cipher in progress and direction of the cipher in progress */
+reg key_busy, block_busy, block_enc;
+
+/* Reset key in the previous cycle, the GPIO holds the line high for many clock cycles */
+reg reset_key_q;
+
+wire enc_sel, load_accept, key_busy_now, busy, block_done;
+
+/* Counters to increment in this cycle */
+wire [7:0] count_en;
+
+integer i;
+
+initial
+begin
+    key_busy = 1'h0;
+    block_busy = 1'h0;
+    block_enc = 1'h0;
+    reset_key_q = 1'h0;
+    for (i = 0; i < 8; i = i + 1)
+        counters[i] = 64'h0;
+    for (i = 0; i < 8; i = i + 1)
+        latched[i] = 64'h0;
+end
+
+/* Direction of the cipher, fixed for encryption only and decryption only cores */
+assign enc_sel = (CIPHER_MODE == CIPHER_ENC) ? 1'h1 : ((CIPHER_MODE == CIPHER_DEC) ? 1'h0 : enc_or_dec_i);
+
+/* The core loads the data only if the keys are ready */
+assign load_accept = load_data_i & key_ready_i;
+
+/* Key ready and cipher ready are low while the core works on the key or block */
+assign key_busy_now = reset_key_i | (key_busy & ~key_ready_i);
+assign busy = key_busy_now | load_accept | (block_busy & ~cipher_ready_i);
+
+/* A block is done once cipher ready goes high */
+assign block_done = block_busy & cipher_ready_i;
+
+assign count_en[PERF_TOTAL_CYCLES] = 1'h1;
+assign count_en[PERF_BUSY_CYCLES] = busy;
+assign count_en[PERF_ENC_BLOCKS] = block_done & block_enc;
+assign count_en[PERF_DEC_BLOCKS] = block_done & ~block_enc;
+assign count_en[PERF_KEY_LOADS] = reset_key_i & ~reset_key_q; // Count the key load once, on the rising edge of reset key
+assign count_en[PERF_KEY_CYCLES] = key_busy_now;
+assign count_en[PERF_OUT_STALL_CYCLES] = cipher_ready_i & ~busy;
+assign count_en[PERF_DROPPED_LOADS] = load_data_i & ~key_ready_i;
+
+always @ (posedge clk_i)
+begin
+    reset_key_q <= reset_key_i;
+
+    /* Track the key schedule */
+    if (reset_key_i)
+        key_busy <= 1'h1;
+    else if (key_ready_i)
+        key_busy <= 1'h0;
+
+    /* Track the cipher */
+    if (load_accept)
+    begin
+        block_busy <= 1'h1;
+        block_enc <= enc_sel;
+    end
+    else if (cipher_ready_i)
+        block_busy <= 1'h0;
+
+    for (i = 0; i < 8; i = i + 1)
+    begin
+        if (perf_clear_i)
+            counters[i] <= 64'h0;
+        else
+            counters[i] <= counters[i] + count_en[i];
+
+        /* Copy all counters in the same cycle, including this cycle's count, so the host reads a consistent and up to date set */
+        if (perf_latch_i)
+            latched[i] <= counters[i] + count_en[i];
+    end
+end
+
+assign perf_data_o = (perf_sel_i[0] == 1'h1) ? latched[perf_sel_i[3:1]][63:32] : latched[perf_sel_i[3:1]][31:0];
+
+endmodule
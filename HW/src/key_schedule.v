@@ -1,6 +1,9 @@
 /* Module to generate round key in for one round in key schedule */
-module key_schedule (round_num, key_i, key_r);
+module key_schedule (clk_i, round_num, key_i, key_r);
 
+parameter SBOX_IMPL = 0; // S-box implementation, see sub_word
+
+input clk_i;
 input [7:0] round_num;
 input [127:0] key_i;
 output [127:0] key_r;
@@ -31,8 +34,8 @@ assign col3_i = { row0_i[7:0],   row1_i[7:0],   row2_i[7:0],   row3_i[7:0]   };
 assign rot_col_3 = { row1_i[7:0], row2_i[7:0], row3_i[7:0], row0_i[7:0] };
 
 /* Substitute word */
-sub_word
-    col3 (.enc_or_dec_i(enc_or_dec_i), .word_i(rot_col_3), .word_o(sub_col_o));
+sub_word #(.SBOX_IMPL(SBOX_IMPL))
+    col3 (.clk_i(clk_i), .enc_or_dec_i(enc_or_dec_i), .word_i(rot_col_3), .word_o(sub_col_o));
 
 /* Rcon column based on the key schedule round */
 rcon
@@ -1,7 +1,14 @@
 /* Module to perform one round in AES128 encryption */
-module round (state_i, key_i, mix_col_i, enc_or_dec_i, state_o);
+module round (clk_i, state_i, key_i, mix_col_i, enc_or_dec_i, state_o);
 
-input mix_col_i, enc_or_dec_i; // Mix columns enable and encryption / decryption select
+parameter SBOX_IMPL = 0;   // S-box implementation, see sub_word
+parameter CIPHER_MODE = 0; // Cipher directions built, see aes128
+parameter ROUND_REG = 0;   // 1: Register the state after the substitute bytes and shift rows stage
+
+`include "aes128_params.vh"
+
+input clk_i;                   // Clock, used by the block RAM S-box and the mid round register
+input mix_col_i, enc_or_dec_i; // Mix columns enable and encryption / decryption select (tied by aes128 in single direction cores)
 input [127:0] state_i, key_i;  // The state and round key input 
 output [127:0] state_o;        // The state output
 
@@ -12,29 +19,69 @@ output [127:0] state_o;        // The state output
     3. Mix Columns
     4. Add round Key
 */
-wire [127:0] sb_i, sr_i, mc_i, ark_i, sb_o, sr_o, mc_o, ark_o, enc_mc_i, dec_mc_i, enc_mc_o, dec_mc_o;
-
-assign enc_mc_i = (enc_or_dec_i == 1) ? mc_i: 0; // Connect the input of mix column module based on encrypt / decrypt
-assign dec_mc_i = (enc_or_dec_i == 1) ? 0 : mc_i;
-assign mc_o = (enc_or_dec_i == 1) ? enc_mc_o : dec_mc_o; // Connect the output of mix column module based on encrypt / decrypt 
+wire [127:0] sb_i, sr_i, mc_i, ark_i, sb_o, sr_o, mc_o, ark_o, sub_o, sub_r;
 
 /* Instantiate all the modules for encryption / decryption of one round */
-sub_bytes
-	sb (.sb_i(sb_i), .enc_or_dec_i(enc_or_dec_i), .sb_o(sb_o));
+sub_bytes #(.SBOX_IMPL(SBOX_IMPL))
+	sb (.clk_i(clk_i), .sb_i(sb_i), .enc_or_dec_i(enc_or_dec_i), .sb_o(sb_o));
 
 shift_rows
     sr (.sr_i(sr_i), .enc_or_dec_i(enc_or_dec_i), .sr_o(sr_o));
 
 /* Have different modules for encryption and decryption due to DRC in FPGA (Artix-7 PL) implementation */
-mix_cols_enc
-	enc_mc (.mix_col_i(mix_col_i), .mc_i(enc_mc_i), .mc_o(enc_mc_o));
-	
-mix_cols_dec
-	dec_mc (.mix_col_i(mix_col_i), .mc_i(dec_mc_i), .mc_o(dec_mc_o));
+generate
+    if (CIPHER_MODE == CIPHER_ENC)
+    begin : enc_only
+        mix_cols_enc
+            enc_mc (.mix_col_i(mix_col_i), .mc_i(mc_i), .mc_o(mc_o));
+    end
+    else if (CIPHER_MODE == CIPHER_DEC)
+    begin : dec_only
+        mix_cols_dec
+            dec_mc (.mix_col_i(mix_col_i), .mc_i(mc_i), .mc_o(mc_o));
+    end
+    else
+    begin : enc_dec
+        wire [127:0] enc_mc_i, dec_mc_i, enc_mc_o, dec_mc_o;
+
+        assign enc_mc_i = (enc_or_dec_i == 1) ? mc_i: 0; // Connect the input of mix column module based on encrypt / decrypt
+        assign dec_mc_i = (enc_or_dec_i == 1) ? 0 : mc_i;
+        assign mc_o = (enc_or_dec_i == 1) ? enc_mc_o : dec_mc_o; // Connect the output of mix column module based on encrypt / decrypt 
+
+        mix_cols_enc
+            enc_mc (.mix_col_i(mix_col_i), .mc_i(enc_mc_i), .mc_o(enc_mc_o));
+            
+        mix_cols_dec
+            dec_mc (.mix_col_i(mix_col_i), .mc_i(dec_mc_i), .mc_o(dec_mc_o));
+    end
+endgenerate
 	
 add_round_key
     rk (.ark_i(ark_i), .key_i(key_i), .ark_o(ark_o));
 
+/* 
+    Output of the substitution half of the round (Sub Bytes and Shift Rows in either order)
+    The block RAM S-box already registers it, otherwise ROUND_REG adds a register here
+    to split the round into two clock cycles
+*/
+assign sub_o = (enc_or_dec_i == 1) ? sr_o : sb_o;
+
+generate
+    if ((ROUND_REG != 0) && (SBOX_IMPL != SBOX_BRAM))
+    begin : mid_reg
+        reg [127:0] sub_q;
+
+        always @ (posedge clk_i)
+            sub_q <= sub_o;
+
+        assign sub_r = sub_q;
+    end
+    else
+    begin : no_mid_reg
+        assign sub_r = sub_o;
+    end
+endgenerate
+
 /* 
     Re-order the round procedure based on the operation: Encryption / Decryption
     Encryption: Sub Bytes -> Shift Rows -> Mix Columns -> Add Round Key
@@ -42,16 +89,18 @@ add_round_key
 */
 assign sb_i =    (enc_or_dec_i == 1) ? state_i : sr_o;
 assign sr_i =    (enc_or_dec_i == 1) ? sb_o : state_i;
-assign mc_i =    (enc_or_dec_i == 1) ? sr_o : ark_o;
-assign ark_i =   (enc_or_dec_i == 1) ? mc_o : sb_o;
+assign mc_i =    (enc_or_dec_i == 1) ? sub_r : ark_o;
+assign ark_i =   (enc_or_dec_i == 1) ? mc_o : sub_r;
 assign state_o = (enc_or_dec_i == 1) ? ark_o : mc_o;
 
 endmodule
 
 /* Module to subsitute bytes & inv substitute bytes */
-module sub_bytes (sb_i, enc_or_dec_i, sb_o);
+module sub_bytes (clk_i, sb_i, enc_or_dec_i, sb_o);
 
-input enc_or_dec_i;
+parameter SBOX_IMPL = 0;
+
+input clk_i, enc_or_dec_i;
 input [127:0] sb_i;
 output [127:0] sb_o;
 
@@ -62,11 +111,11 @@ wire [31:0] row0_i, row1_i, row2_i, row3_i,
 assign { row0_i, row1_i, row2_i, row3_i } = sb_i;
 
 /* Substitute double word individually */
-sub_word
-	row0 (.enc_or_dec_i(enc_or_dec_i), .word_i(row0_i), .word_o(row0_o)),
-	row1 (.enc_or_dec_i(enc_or_dec_i), .word_i(row1_i), .word_o(row1_o)),
-	row2 (.enc_or_dec_i(enc_or_dec_i), .word_i(row2_i), .word_o(row2_o)),
-	row3 (.enc_or_dec_i(enc_or_dec_i), .word_i(row3_i), .word_o(row3_o));
+sub_word #(.SBOX_IMPL(SBOX_IMPL))
+	row0 (.clk_i(clk_i), .enc_or_dec_i(enc_or_dec_i), .word_i(row0_i), .word_o(row0_o)),
+	row1 (.clk_i(clk_i), .enc_or_dec_i(enc_or_dec_i), .word_i(row1_i), .word_o(row1_o)),
+	row2 (.clk_i(clk_i), .enc_or_dec_i(enc_or_dec_i), .word_i(row2_i), .word_o(row2_o)),
+	row3 (.clk_i(clk_i), .enc_or_dec_i(enc_or_dec_i), .word_i(row3_i), .word_o(row3_o));
 	
 assign sb_o = { row0_o, row1_o, row2_o, row3_o };
 
@@ -0,0 +1,23 @@
+/*
+    S box ROM in dual port block RAM
+    Both tables share one ROM: S box at 0x000 - 0x0FF and inverse S box at 0x100 - 0x1FF
+    Port A and port B substitute two different bytes in the same clock cycle
+    The read is synchronous, hence the substituted bytes are available one clock cycle later
+*/
+module S_Box_BRAM (clk_i, enc_or_dec_i, in_a, in_b, out_a, out_b);
+    input clk_i, enc_or_dec_i;
+    input [7:0] in_a, in_b;
+    output reg [7:0] out_a, out_b;
+
+    (* rom_style = "block" *) reg [7:0] rom [0:511];
+
+    /* Load the S box and inverse S box tables (sbox_rom.mem must be added to the project) */
+    initial $readmemh("sbox_rom.mem", rom);
+
+    /* Upper half of the ROM holds the inverse S box used in decryption */
+    always @ (posedge clk_i)
+    begin
+        out_a <= rom[{~enc_or_dec_i, in_a}];
+        out_b <= rom[{~enc_or_dec_i, in_b}];
+    end
+endmodule
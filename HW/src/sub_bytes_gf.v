@@ -0,0 +1,94 @@
+/*
+    Composite field S box
+    The multiplicative inverse is computed in GF((2^4)^2) instead of looking it up in GF(2^8)
+    1. GF(2^4): x^4 + x + 1
+    2. GF((2^4)^2): y^2 + y + 8, a byte { a1, a0 } holds the element a1.y + a0
+    The basis change into the composite field and the affine transform are merged into one
+    8x8 bit matrix at the input and one at the output, so a single inverter does both
+    S box (encryption) and inverse S box (decryption)
+*/
+module S_Box_GF (enc_or_dec_i, in, out);
+    input enc_or_dec_i;
+    input [7:0] in;
+    output [7:0] out;
+
+    /*
+        Bit matrices, row of output bit 7 first:
+        1. Encryption input: GF(2^8) -> GF((2^4)^2)
+        2. Decryption input: inverse affine, then GF(2^8) -> GF((2^4)^2) (0x63 folded into 0x47)
+        3. Encryption output: GF((2^4)^2) -> GF(2^8), then affine (0x63 added below)
+        4. Decryption output: GF((2^4)^2) -> GF(2^8)
+    */
+    localparam  ENC_MAP_IN  = 64'hA0ACD27018FC04A1,
+                DEC_MAP_IN  = 64'hC67178F76F129262,
+                ENC_MAP_OUT = 64'h06D0EE3B25693F45,
+                DEC_MAP_OUT = 64'hD48E54CAC202B081;
+
+    wire [7:0] map_i, inv_o;
+    wire [3:0] a1, a0, d, d_inv;
+
+    /* Move the input into the composite field */
+    assign map_i = (enc_or_dec_i == 1'h1) ? gf_map(in, ENC_MAP_IN) : (gf_map(in, DEC_MAP_IN) ^ 8'h47);
+
+    /* Inverse of a1.y + a0 is (a1.y + a0 + a1) / d, with d = a1^2.8 + a1.a0 + a0^2 */
+    assign { a1, a0 } = map_i;
+    assign d = gf16_mul(gf16_mul(a1, a1), 4'h8) ^ gf16_mul(a1, a0) ^ gf16_mul(a0, a0);
+
+    gf16_inv
+        inv_d (d, d_inv);
+
+    assign inv_o = { gf16_mul(a1, d_inv), gf16_mul(a0 ^ a1, d_inv) };
+
+    /* Move the inverse back to GF(2^8) */
+    assign out = (enc_or_dec_i == 1'h1) ? (gf_map(inv_o, ENC_MAP_OUT) ^ 8'h63) : gf_map(inv_o, DEC_MAP_OUT);
+
+    /* Multiply a byte by an 8x8 bit matrix */
+    function [7:0] gf_map;
+        input [7:0] x;
+        input [63:0] m;
+        integer i;
+        begin
+            for (i = 0; i < 8; i = i + 1)
+                gf_map[i] = ^(x & m[i * 8 +: 8]);
+        end
+    endfunction
+
+    /* Multiply in GF(2^4), reduce x^4 = x + 1 */
+    function [3:0] gf16_mul;
+        input [3:0] a, b;
+        reg [6:0] p;
+        begin
+            p = ({ 3'b0, a       } & {7{b[0]}}) ^
+                ({ 2'b0, a, 1'b0 } & {7{b[1]}}) ^
+                ({ 1'b0, a, 2'b0 } & {7{b[2]}}) ^
+                ({ a, 3'b0       } & {7{b[3]}});
+            gf16_mul = { p[3] ^ p[6], p[2] ^ p[5] ^ p[6], p[1] ^ p[4] ^ p[5], p[0] ^ p[4] };
+        end
+    endfunction
+endmodule
+
+/* GF(2^4) inverse LUT */
+module gf16_inv (in, out);
+    input [3:0] in;
+    output reg [3:0] out;
+
+    always @ (in)
+    case (in)
+        4'h0: out = 4'h0;
+        4'h1: out = 4'h1;
+        4'h2: out = 4'h9;
+        4'h3: out = 4'he;
+        4'h4: out = 4'hd;
+        4'h5: out = 4'hb;
+        4'h6: out = 4'h7;
+        4'h7: out = 4'h6;
+        4'h8: out = 4'hf;
+        4'h9: out = 4'h2;
+        4'ha: out = 4'hc;
+        4'hb: out = 4'h5;
+        4'hc: out = 4'ha;
+        4'hd: out = 4'h4;
+        4'he: out = 4'h3;
+        4'hf: out = 4'h8;
+    endcase
+endmodule
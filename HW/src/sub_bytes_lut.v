@@ -1,27 +1,58 @@
-/* Module to substitute word */
-module sub_word (enc_or_dec_i, word_i, word_o);
+/* 
+    Module to substitute word
+    SBOX_IMPL selects the S-box implementation:
+    0. SBOX_LUT: 256-entry case tables, separate S box and inverse S box per byte (combinational)
+    1. SBOX_BRAM: Dual port block RAM ROM shared by two bytes, holds both tables (output registered, 1 cycle latency)
+    2. SBOX_GF: Composite field GF((2^4)^2) inverter shared by S box and inverse S box (combinational)
+*/
+module sub_word (clk_i, enc_or_dec_i, word_i, word_o);
 
-input enc_or_dec_i;
+parameter SBOX_IMPL = 0;
+
+`include "aes128_params.vh"
+
+input clk_i, enc_or_dec_i;
 input [31:0] word_i;
 output [31:0] word_o;
 
-wire [31:0] sbox_o, inv_sbox_o;
+generate
+    if (SBOX_IMPL == SBOX_BRAM)
+    begin : bram
+        /* Each block RAM serves two bytes through its two read ports */
+        S_Box_BRAM
+            sbox_e12 (.clk_i(clk_i), .enc_or_dec_i(enc_or_dec_i), .in_a(word_i[31:24]), .in_b(word_i[23:16]), .out_a(word_o[31:24]), .out_b(word_o[23:16])),
+            sbox_e34 (.clk_i(clk_i), .enc_or_dec_i(enc_or_dec_i), .in_a(word_i[15:8]),  .in_b(word_i[7:0]),   .out_a(word_o[15:8]),  .out_b(word_o[7:0]));
+    end
+    else if (SBOX_IMPL == SBOX_GF)
+    begin : gf
+        /* One composite field S box per byte does both substitute and inv substitute */
+        S_Box_GF
+            sbox_e1 (enc_or_dec_i, word_i[31:24], word_o[31:24]),
+            sbox_e2 (enc_or_dec_i, word_i[23:16], word_o[23:16]),
+            sbox_e3 (enc_or_dec_i, word_i[15:8],  word_o[15:8]),
+            sbox_e4 (enc_or_dec_i, word_i[7:0],   word_o[7:0]);
+    end
+    else
+    begin : lut
+        wire [31:0] sbox_o, inv_sbox_o;
 
-assign word_o = (enc_or_dec_i == 1'h1) ? sbox_o : inv_sbox_o;
+        assign word_o = (enc_or_dec_i == 1'h1) ? sbox_o : inv_sbox_o;
 
-/* Instantiate S-Box modules to substitute bytes */
-S_Box
-	sbox_e1 (word_i[31:24], sbox_o[31:24]),
-	sbox_e2 (word_i[23:16], sbox_o[23:16]),
-	sbox_e3 (word_i[15:8],   sbox_o[15:8]),
-	sbox_e4 (word_i[7:0],     sbox_o[7:0]);
-	
-/* Instantiate inverse S-Box modules to substitute bytes */
-inv_S_Box
-	inv_sbox_e1 (word_i[31:24], inv_sbox_o[31:24]),
-	inv_sbox_e2 (word_i[23:16], inv_sbox_o[23:16]),
-	inv_sbox_e3 (word_i[15:8],   inv_sbox_o[15:8]),
-	inv_sbox_e4 (word_i[7:0],     inv_sbox_o[7:0]);
+        /* Instantiate S-Box modules to substitute bytes */
+        S_Box
+            sbox_e1 (word_i[31:24], sbox_o[31:24]),
+            sbox_e2 (word_i[23:16], sbox_o[23:16]),
+            sbox_e3 (word_i[15:8],   sbox_o[15:8]),
+            sbox_e4 (word_i[7:0],     sbox_o[7:0]);
+            
+        /* Instantiate inverse S-Box modules to substitute bytes */
+        inv_S_Box
+            inv_sbox_e1 (word_i[31:24], inv_sbox_o[31:24]),
+            inv_sbox_e2 (word_i[23:16], inv_sbox_o[23:16]),
+            inv_sbox_e3 (word_i[15:8],   inv_sbox_o[15:8]),
+            inv_sbox_e4 (word_i[7:0],     inv_sbox_o[7:0]);
+    end
+endgenerate
 
 endmodule
 
@@ -0,0 +1,309 @@
+`timescale 1ns / 1ps
+//////////////////////////////////////////////////////////////////////////////////
+// Create Date: 10/19/2026
+// Design Name: AES128 Core
+// Module Name: aes128_bench_tb
+// Project Name: AES128
+// Target Devices: NA
+// Description: Cycle accurate correctness and throughput benchmark. Streams random
+//              vectors from aes128_vectors (SW golden model) through the aes128 core
+//              and reports blocks per cycle, key switch latency and idle cycles
+//
+// Dependencies: Design files, vector file from aes128_vectors
+//
+// Revision: 1
+// Revision 0.01 - File Created
+// Additional Comments: Run through HW/tests/Makefile
+//
+//////////////////////////////////////////////////////////////////////////////////
+
+
+module aes128_bench_tb;
+
+/* Core variant under test, see aes128 */
+parameter SBOX_IMPL = 0;
+parameter CIPHER_MODE = 0;
+parameter ROUND_REG = 0;
+
+/* Give up on a key schedule or block after this many clock cycles */
+localparam TIMEOUT_CYCLES = 1000;
+
+/* Clock cycles reset key is held high, an AXI GPIO write holds it for more than one cycle */
+localparam KEY_LOAD_CYCLES = 2;
+
+reg clk;
+
+/* Clock period */
+localparam CLK_PERIOD = 10;
+initial clk = 1'b0;
+
+/* Generate clock */
+always # (CLK_PERIOD / 2)
+    clk = ~clk;
+
+/* Declarations for using AES128 module */
+reg reset_key_i, load_data_i, enc_or_dec_i;
+reg [127:0] plain_text_i, cipher_key_i;
+
+wire [127:0] cipher_text;
+wire cipher_ready, key_ready;
+
+initial reset_key_i = 0;
+initial load_data_i = 0;
+initial enc_or_dec_i = 1;
+initial plain_text_i = 0;
+initial cipher_key_i = 0;
+
+/* Instantiate AES128 module within TB */
+aes128 #(.SBOX_IMPL(SBOX_IMPL), .CIPHER_MODE(CIPHER_MODE), .ROUND_REG(ROUND_REG))
+    dut (.clk_i(clk), .reset_key_i(reset_key_i), .load_data_i(load_data_i), .plain_text_i(plain_text_i),
+         .cipher_key_i(cipher_key_i), .enc_or_dec_i(enc_or_dec_i), .cipher_text_o(cipher_text), .cipher_ready_o(cipher_ready),
+         .key_ready_o(key_ready));
+
+/* Performance counters next to the core, read back at the end and checked against the TB counts */
+reg perf_latch_i, perf_clear_i;
+reg [3:0] perf_sel_i;
+wire [31:0] perf_data;
+reg [63:0] perf_values [0:7];
+
+initial perf_latch_i = 0;
+initial perf_clear_i = 0;
+initial perf_sel_i = 0;
+
+aes128_perf #(.CIPHER_MODE(CIPHER_MODE))
+    perf (.clk_i(clk), .reset_key_i(reset_key_i), .load_data_i(load_data_i), .enc_or_dec_i(enc_or_dec_i),
+          .key_ready_i(key_ready), .cipher_ready_i(cipher_ready), .perf_latch_i(perf_latch_i), .perf_clear_i(perf_clear_i),
+          .perf_sel_i(perf_sel_i), .perf_data_o(perf_data));
+
+/*
+    What the core is doing in the current cycle, as seen by the host:
+    1. PHASE_IDLE: Waiting for the host
+    2. PHASE_KEY: Key schedule, from reset_key_i until key_ready_o
+    3. PHASE_BLOCK: Cipher, from load_data_i until cipher_ready_o
+*/
+localparam  PHASE_IDLE = 2'd0,
+            PHASE_KEY = 2'd1,
+            PHASE_BLOCK = 2'd2;
+
+reg [1:0] phase;
+initial phase = PHASE_IDLE;
+
+/* Cycle counters, 64-bit to hold millions of blocks */
+reg [63:0] total_cycles, key_cycles, block_cycles, idle_cycles;
+reg [63:0] num_blocks, num_keys, num_errors, num_enc_blocks;
+reg [63:0] key_latency_min, key_latency_max, block_latency_min, block_latency_max;
+
+initial total_cycles = 0;
+initial key_cycles = 0;
+initial block_cycles = 0;
+initial idle_cycles = 0;
+
+always @ (posedge clk)
+begin
+    total_cycles <= total_cycles + 1;
+    case (phase)
+        PHASE_KEY: key_cycles <= key_cycles + 1;
+        PHASE_BLOCK: block_cycles <= block_cycles + 1;
+        default: idle_cycles <= idle_cycles + 1;
+    endcase
+end
+
+/* Vector file fields */
+integer fd, fields, wait_cycles, counter;
+
+/* Host delay between collecting a result and loading the next block, random 0 .. host_gap cycles */
+integer host_gap, gap_seed, gap_cycles;
+reg [127:0] vec_key, vec_in, vec_out, cur_key;
+reg [7:0] vec_op;
+reg key_loaded;
+reg [1023:0] vec_file;
+
+initial
+begin
+    if (!$value$plusargs("VECTORS=%s", vec_file))
+        vec_file = "vectors.txt";
+    /* +GAP=0 loads back to back, use it for the blocks per cycle figure */
+    if (!$value$plusargs("GAP=%d", host_gap))
+        host_gap = 0;
+    if (!$value$plusargs("GAP_SEED=%d", gap_seed))
+        gap_seed = 1;
+
+    fd = $fopen(vec_file, "r");
+    if (fd == 0)
+    begin
+        $display("ERROR: cannot open vector file %0s", vec_file);
+        $finish;
+    end
+
+    num_blocks = 0;
+    num_keys = 0;
+    num_errors = 0;
+    num_enc_blocks = 0;
+    key_latency_min = {64{1'b1}};
+    key_latency_max = 0;
+    block_latency_min = {64{1'b1}};
+    block_latency_max = 0;
+    key_loaded = 0;
+    cur_key = 0;
+
+    /* 
+        Inputs are driven while the clock is low, the core samples them on the rising edge.
+        Start before the first rising edge so the only idle cycles are the ones with a result waiting
+    */
+    #1;
+
+    fields = $fscanf(fd, "%h %h %h %h\n", vec_op, vec_key, vec_in, vec_out);
+    while (fields == 4)
+    begin
+        /* New key: Make the reset key high for one clock cycle and wait for the key schedule */
+        if (!key_loaded || (vec_key != cur_key))
+        begin
+            cipher_key_i = vec_key;
+            reset_key_i = 1;
+            phase = PHASE_KEY;
+            for (wait_cycles = 0; wait_cycles < KEY_LOAD_CYCLES; wait_cycles = wait_cycles + 1)
+                @ (negedge clk);
+            reset_key_i = 0;
+            wait_cycles = KEY_LOAD_CYCLES;
+            while (!key_ready && (wait_cycles < TIMEOUT_CYCLES))
+            begin
+                @ (negedge clk);
+                wait_cycles = wait_cycles + 1;
+            end
+            if (!key_ready)
+            begin
+                $display("ERROR: key schedule timed out after %0d cycles", wait_cycles);
+                $finish;
+            end
+            if (wait_cycles < key_latency_min) key_latency_min = wait_cycles;
+            if (wait_cycles > key_latency_max) key_latency_max = wait_cycles;
+            num_keys = num_keys + 1;
+            cur_key = vec_key;
+            key_loaded = 1;
+        end
+
+        /* Make the load data high for one clock cycle and wait for the cipher */
+        enc_or_dec_i = vec_op[0];
+        plain_text_i = vec_in;
+        load_data_i = 1;
+        phase = PHASE_BLOCK;
+        @ (negedge clk);
+        load_data_i = 0;
+        wait_cycles = 1;
+        while (!cipher_ready && (wait_cycles < TIMEOUT_CYCLES))
+        begin
+            @ (negedge clk);
+            wait_cycles = wait_cycles + 1;
+        end
+        if (!cipher_ready)
+        begin
+            $display("ERROR: block %0d timed out after %0d cycles", num_blocks, wait_cycles);
+            $finish;
+        end
+        if (wait_cycles < block_latency_min) block_latency_min = wait_cycles;
+        if (wait_cycles > block_latency_max) block_latency_max = wait_cycles;
+
+        /* Compare against the SW golden model */
+        if (cipher_text !== vec_out)
+        begin
+            num_errors = num_errors + 1;
+            if (num_errors <= 10)
+                $display("ERROR: block %0d %0s key %h in %h expected %h got %h", num_blocks,
+                         vec_op[0] ? "enc" : "dec", vec_key, vec_in, vec_out, cipher_text);
+        end
+        num_blocks = num_blocks + 1;
+        num_enc_blocks = num_enc_blocks + vec_op[0];
+
+        /* The host collects the output and waits before loading the next block, the core is idle meanwhile */
+        phase = PHASE_IDLE;
+        if (host_gap != 0)
+        begin
+            gap_cycles = {$random(gap_seed)} % (host_gap + 1);
+            repeat (gap_cycles)
+                @ (negedge clk);
+        end
+        fields = $fscanf(fd, "%h %h %h %h\n", vec_op, vec_key, vec_in, vec_out);
+    end
+
+    $fclose(fd);
+
+    /* Latch the performance counters on the final edge, the latched values include that edge like the TB counters */
+    perf_latch_i = 1;
+    @ (posedge clk);
+    #1;
+    perf_latch_i = 0;
+
+    /* Read back each counter 32-bits at a time */
+    for (counter = 0; counter < 8; counter = counter + 1)
+    begin
+        perf_sel_i = { counter[2:0], 1'b1 };
+        #1 perf_values[counter][63:32] = perf_data;
+        perf_sel_i = { counter[2:0], 1'b0 };
+        #1 perf_values[counter][31:0] = perf_data;
+    end
+
+    if (perf_values[0] != total_cycles)
+    begin
+        num_errors = num_errors + 1;
+        $display("ERROR: perf total cycles %0d expected %0d", perf_values[0], total_cycles);
+    end
+    if (perf_values[1] != key_cycles + block_cycles)
+    begin
+        num_errors = num_errors + 1;
+        $display("ERROR: perf busy cycles %0d expected %0d", perf_values[1], key_cycles + block_cycles);
+    end
+    if ((perf_values[2] != num_enc_blocks) || (perf_values[3] != num_blocks - num_enc_blocks))
+    begin
+        num_errors = num_errors + 1;
+        $display("ERROR: perf blocks %0d enc %0d dec expected %0d enc %0d dec", perf_values[2], perf_values[3],
+                 num_enc_blocks, num_blocks - num_enc_blocks);
+    end
+    if (perf_values[4] != num_keys)
+    begin
+        num_errors = num_errors + 1;
+        $display("ERROR: perf key loads %0d expected %0d", perf_values[4], num_keys);
+    end
+    if (perf_values[5] != key_cycles)
+    begin
+        num_errors = num_errors + 1;
+        $display("ERROR: perf key schedule cycles %0d expected %0d", perf_values[5], key_cycles);
+    end
+    /* The core is only idle with a result waiting, before the host loads the next block or key */
+    if (perf_values[6] != idle_cycles)
+    begin
+        num_errors = num_errors + 1;
+        $display("ERROR: perf output stall cycles %0d expected %0d", perf_values[6], idle_cycles);
+    end
+    /* The bench only loads a block once the key is ready */
+    if (perf_values[7] != 0)
+    begin
+        num_errors = num_errors + 1;
+        $display("ERROR: perf dropped loads %0d expected 0", perf_values[7]);
+    end
+
+    $display("AES128 benchmark: SBOX_IMPL=%0d CIPHER_MODE=%0d ROUND_REG=%0d GAP=%0d", SBOX_IMPL, CIPHER_MODE, ROUND_REG, host_gap);
+    $display("  Blocks:              %0d (%0d errors)", num_blocks, num_errors);
+    $display("  Keys:                %0d", num_keys);
+    $display("  Total cycles:        %0d", total_cycles);
+    $display("  Key schedule cycles: %0d", key_cycles);
+    $display("  Cipher cycles:       %0d", block_cycles);
+    $display("  Idle cycles:         %0d", idle_cycles);
+    if (num_blocks != 0)
+    begin
+        $display("  Block latency:       %0d - %0d cycles", block_latency_min, block_latency_max);
+        $display("  Key switch latency:  %0d - %0d cycles", key_latency_min, key_latency_max);
+        $display("  Blocks per cycle:    %0f", $itor(num_blocks) / $itor(total_cycles));
+        $display("  Cycles per block:    %0f", $itor(total_cycles) / $itor(num_blocks));
+        $display("  Perf counters:       busy %0d, enc %0d, dec %0d, keys %0d, key schedule %0d, output stall %0d, dropped %0d",
+                 perf_values[1], perf_values[2], perf_values[3], perf_values[4], perf_values[5], perf_values[6], perf_values[7]);
+    end
+
+    if ((num_errors == 0) && (num_blocks != 0))
+        $display("PASS");
+    else
+        $display("FAIL");
+
+    $finish;
+end
+
+endmodule
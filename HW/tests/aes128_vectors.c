@@ -0,0 +1,116 @@
+/********************************************************************************
+* @file     aes128_vectors.c                                                    *
+* @brief    Random test vector generator for the AES128 HW benchmark            *
+* @date     19-Oct-2026                                                         *
+*********************************************************************************
+*                                                                               *
+* This program is free software: you can redistribute it and/or modify it       *
+* under the terms of the GNU General Public License as published by the Free    *
+* Software Foundation, either version 3 of the License, or (at your option)     *
+* any later version.                                                            *
+*                                                                               *
+* This program is distributed in the hope that it will be useful, but           *
+* WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY    *
+* or FITNESS FOR A PARTICULAR PURPOSE.                                          *
+* See the GNU General Public License for more details.                          *
+*                                                                               *
+* You should have received a copy of the GNU General Public License             *
+* along with this program. If not, see <https://www.gnu.org/licenses/>.         *
+*                                                                               *
+********************************************************************************/
+
+/*
+    Usage: aes128_vectors <blocks> <blocks_per_key> <cipher_mode> <seed>
+
+    Writes one vector per line to stdout, read by aes128_bench_tb.v:
+    <enc_or_dec> <cipher_key> <input_block> <expected_output>
+
+    The 128-bit values use the same byte order as the SW state matrix and the
+    HW bus (row major, byte 0 in bits 127:120). The cipher_mode matches the
+    CIPHER_MODE parameter of the aes128 core: 0 mixes encryption and decryption,
+    1 generates encryption only and 2 decryption only.
+*/
+
+#include <stdlib.h>
+#include "../../SW/aes128_cbc.h"
+
+/* xorshift64 PRNG so the vectors are the same on every host for a given seed */
+static uint64_t aes128_vectors_seed;
+
+static uint8_t aes128_vectors_rand (void)
+{
+    aes128_vectors_seed ^= aes128_vectors_seed << 13;
+    aes128_vectors_seed ^= aes128_vectors_seed >> 7;
+    aes128_vectors_seed ^= aes128_vectors_seed << 17;
+
+    return (uint8_t)(aes128_vectors_seed >> 32);
+}
+
+static void aes128_vectors_print (uint8_t *block)
+{
+    for (uint8_t byte = 0u; byte < 16u; byte++)
+    {
+        printf("%02x", block[byte]);
+    }
+}
+
+int main (int argc, char *argv[])
+{
+    if (argc != 5)
+    {
+        fprintf(stderr, "Usage: %s <blocks> <blocks_per_key> <cipher_mode> <seed>\n", argv[0]);
+        return 1;
+    }
+
+    unsigned long num_blocks = strtoul(argv[1], NULL, 0);
+    unsigned long blocks_per_key = strtoul(argv[2], NULL, 0);
+    unsigned long cipher_mode = strtoul(argv[3], NULL, 0);
+    aes128_vectors_seed = strtoull(argv[4], NULL, 0) ^ 0x9E3779B97F4A7C15u;
+
+    if ((blocks_per_key == 0u) || (cipher_mode > 2u))
+    {
+        fprintf(stderr, "blocks_per_key must be non-zero and cipher_mode 0, 1 or 2\n");
+        return 1;
+    }
+
+    uint8_t cipherKey[16u], inputBlock[16u], outputBlock[16u];
+
+    for (unsigned long block = 0u; block < num_blocks; block++)
+    {
+        /* Generate a new key and run the key schedule every blocks_per_key blocks */
+        if ((block % blocks_per_key) == 0u)
+        {
+            for (uint8_t byte = 0u; byte < 16u; byte++)
+            {
+                cipherKey[byte] = aes128_vectors_rand();
+            }
+            aes128_key_schedule (cipherKey);
+        }
+
+        for (uint8_t byte = 0u; byte < 16u; byte++)
+        {
+            inputBlock[byte] = aes128_vectors_rand();
+        }
+
+        bool encrypt = (cipher_mode == 1u) || ((cipher_mode == 0u) && (aes128_vectors_rand() & 1u));
+
+        if (encrypt)
+        {
+            aes128_encrypt (inputBlock, outputBlock);
+        }
+        else
+        {
+            aes128_decrypt (inputBlock, outputBlock);
+        }
+
+        printf("%d ", encrypt);
+        aes128_vectors_print(cipherKey);
+        printf(" ");
+        aes128_vectors_print(inputBlock);
+        printf(" ");
+        aes128_vectors_print(outputBlock);
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -203,7 +203,7 @@ uint8_t aes128_column_mix_matrix_inv[16u] =
 
 uint8_t aes128_rcon[10u] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
 
-uint8_t aes128_round_keys[10u][16u];
+uint8_t aes128_round_keys[11u][16u];
 
 #define STATE_ROWS          4u
 #define KEY_ROWS            4u